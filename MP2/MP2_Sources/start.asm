@@ -42,8 +42,13 @@ mboot:
 ; This is an endless loop here. Make a note of this: Later on, we
 ; will insert an 'extern _main', followed by 'call _main', right
 ; before the 'jmp $'.
+; The multiboot loader leaves its magic number in EAX and the address of
+; the multiboot information structure in EBX. We hand both to main, which
+; reads the memory map out of the latter.
 stublet:
     extern _main
+    push ebx
+    push eax
     call _main
     jmp $
 
@@ -52,6 +57,7 @@ stublet:
 ; downwards, so we declare the size of the data before declaring
 ; the identifier '_sys_stack'
 SECTION .bss
-    resb 8192               ; This reserves 8KBytes of memory here
+    resb 16384              ; This reserves 16KBytes of memory here
+                            ; (the frame pools live on main's stack)
 _sys_stack:
 